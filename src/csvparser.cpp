@@ -19,98 +19,69 @@ bool CsvParser::parseTimestamps(const QString &filePath,
                                 QList<QDateTime> &processTimes,
                                 QChar delimiter)
 {
-    // Clear any previous error message
-    m_errorMessage.clear();
-    
     // Clear output lists
     eventTimes.clear();
     processTimes.clear();
-    
-    // Open the file
+
+    return forEachTimestampRow(
+        filePath,
+        eventTimeColumn,
+        processTimeColumn,
+        [&](int, const QDateTime &eventTime, const QDateTime &processTime, const QStringList &) {
+            eventTimes.append(eventTime);
+            processTimes.append(processTime);
+            return true;
+        },
+        delimiter);
+}
+
+bool CsvParser::readHeader(const QString &filePath, QStringList &headers, QChar delimiter)
+{
+    // Clear any previous error message
+    m_errorMessage.clear();
+
     QFile file(filePath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        m_errorMessage = "Could not open the file.";
-        return false;
-    }
-    
-    // Set up text stream with UTF-8 encoding
-    QTextStream in(&file);
-    in.setEncoding(QStringConverter::Utf8);
-    
-    // Read header line
-    if (in.atEnd()) {
-        m_errorMessage = "File is empty.";
-        file.close();
-        return false;
-    }
-    
-    QString headerLine = in.readLine();
-    QStringList headers = parseLine(headerLine, delimiter);
-    
-    // Find column indices
-    int eventTimeIndex = -1;
-    int processTimeIndex = -1;
-    
-    for (int i = 0; i < headers.size(); i++) {
-        QString header = headers[i].trimmed();
-        if (header.compare(eventTimeColumn, Qt::CaseInsensitive) == 0) {
-            eventTimeIndex = i;
-        } else if (header.compare(processTimeColumn, Qt::CaseInsensitive) == 0) {
-            processTimeIndex = i;
-        }
-    }
-    
-    // Validate column indices
-    if (eventTimeIndex == -1 || processTimeIndex == -1) {
-        m_errorMessage = QString("Required columns '%1' and '%2' not found. Found columns: %3")
-                             .arg(eventTimeColumn, processTimeColumn, headers.join(", "));
-        file.close();
+    QTextStream in;
+    return openFile(file, in, headers, delimiter);
+}
+
+bool CsvParser::forEachTimestampRow(const QString &filePath,
+                                    const QString &eventTimeColumn,
+                                    const QString &processTimeColumn,
+                                    const TimestampRowHandler &handler,
+                                    QChar delimiter)
+{
+    RowReader reader(this, delimiter);
+    if (!reader.open(filePath, { eventTimeColumn, processTimeColumn })) {
         return false;
     }
     
     // Process data rows
-    int lineNumber = 1; // Header was line 1
-    while (!in.atEnd()) {
-        lineNumber++;
-        QString line = in.readLine();
-        if (line.trimmed().isEmpty()) {
-            continue;
-        }
-        
-        QStringList fields = parseLine(line, delimiter);
-        
-        // Check if we have enough fields
-        if (fields.size() <= qMax(eventTimeIndex, processTimeIndex)) {
-            qDebug() << "Line" << lineNumber << "has insufficient fields:" << fields.size() 
-                     << "fields, need index" << qMax(eventTimeIndex, processTimeIndex);
-            continue;
-        }
-        
+    int validRows = 0;
+    while (reader.next()) {
         // Parse timestamps
-        QString eventTimeStr = fields[eventTimeIndex].trimmed();
-        QString processTimeStr = fields[processTimeIndex].trimmed();
-        
-        QDateTime eventTime = parseDateTime(eventTimeStr);
-        QDateTime processTime = parseDateTime(processTimeStr);
+        QDateTime eventTime = reader.dateTime(0);
+        QDateTime processTime = reader.dateTime(1);
         
         if (eventTime.isValid() && processTime.isValid()) {
-            eventTimes.append(eventTime);
-            processTimes.append(processTime);
+            validRows++;
+            if (!handler(reader.lineNumber(), eventTime, processTime, reader.fields())) {
+                m_errorMessage = QString("Processing stopped at line %1.").arg(reader.lineNumber());
+                return false;
+            }
         } else {
             // Debug invalid timestamps
             if (!eventTime.isValid()) {
-                qDebug() << "Invalid event time format at line" << lineNumber << ":" << eventTimeStr;
+                qDebug() << "Invalid event time format at line" << reader.lineNumber() << ":" << reader.value(0);
             }
             if (!processTime.isValid()) {
-                qDebug() << "Invalid process time format at line" << lineNumber << ":" << processTimeStr;
+                qDebug() << "Invalid process time format at line" << reader.lineNumber() << ":" << reader.value(1);
             }
         }
     }
     
-    file.close();
-    
     // Check if we parsed any valid data
-    if (eventTimes.isEmpty()) {
+    if (validRows == 0) {
         m_errorMessage = "No valid data rows found in the file.";
         return false;
     }
@@ -118,6 +89,72 @@ bool CsvParser::parseTimestamps(const QString &filePath,
     return true;
 }
 
+bool CsvParser::isSortedByColumn(const QString &filePath,
+                                 const QString &column,
+                                 bool &sorted,
+                                 QChar delimiter)
+{
+    sorted = false;
+
+    RowReader reader(this, delimiter);
+    if (!reader.open(filePath, { column })) {
+        return false;
+    }
+
+    // Stop at the first row that is out of order
+    QString previousValue;
+    bool hasPrevious = false;
+    while (reader.next()) {
+        QString value = reader.value(0);
+        if (value.isEmpty()) {
+            continue;
+        }
+        if (hasPrevious && value.compare(previousValue) < 0) {
+            return true;
+        }
+        previousValue = value;
+        hasPrevious = true;
+    }
+
+    sorted = true;
+    return true;
+}
+
+bool CsvParser::openFile(QFile &file, QTextStream &in, QStringList &headers, QChar delimiter)
+{
+    // Open the file
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        m_errorMessage = "Could not open the file.";
+        return false;
+    }
+    
+    // Set up text stream with UTF-8 encoding
+    in.setDevice(&file);
+    in.setEncoding(QStringConverter::Utf8);
+    
+    // Read header line
+    if (in.atEnd()) {
+        m_errorMessage = "File is empty.";
+        file.close();
+        return false;
+    }
+    
+    headers = parseLine(in.readLine(), delimiter);
+    return true;
+}
+
+int CsvParser::columnIndex(const QStringList &headers, const QString &column)
+{
+    // The last matching header wins when a name is repeated
+    int index = -1;
+    for (int i = 0; i < headers.size(); i++) {
+        if (headers[i].trimmed().compare(column.trimmed(), Qt::CaseInsensitive) == 0) {
+            index = i;
+        }
+    }
+    return index;
+}
+
 QStringList CsvParser::parseLine(const QString &line, QChar delimiter)
 {
     QStringList fields;
@@ -198,4 +235,92 @@ QDateTime CsvParser::parseDateTime(const QString &dateTimeStr)
 QString CsvParser::errorMessage() const
 {
     return m_errorMessage;
-}
\ No newline at end of file
+}
+
+CsvParser::RowReader::RowReader(CsvParser *parser, QChar delimiter)
+    : m_parser(parser)
+    , m_delimiter(delimiter)
+    , m_maxIndex(-1)
+    , m_lineNumber(1)
+    , m_rowLine(0)
+{
+}
+
+bool CsvParser::RowReader::open(const QString &filePath, const QStringList &columns)
+{
+    // Clear any previous error message
+    m_parser->m_errorMessage.clear();
+
+    m_file.setFileName(filePath);
+    QStringList headers;
+    if (!m_parser->openFile(m_file, m_in, headers, m_delimiter)) {
+        return false;
+    }
+
+    // Find column indices
+    m_indices.clear();
+    m_maxIndex = -1;
+    for (const QString &column : columns) {
+        int index = columnIndex(headers, column);
+        if (index == -1) {
+            m_parser->m_errorMessage = QString("Required %1 '%2' not found. Found columns: %3")
+                                           .arg(columns.size() == 1 ? "column" : "columns",
+                                                columns.join("' and '"),
+                                                headers.join(", "));
+            m_file.close();
+            return false;
+        }
+        m_indices.append(index);
+        m_maxIndex = qMax(m_maxIndex, index);
+    }
+
+    m_lineNumber = 1; // Header was line 1
+    return true;
+}
+
+bool CsvParser::RowReader::next()
+{
+    while (!m_in.atEnd()) {
+        m_lineNumber++;
+        QString line = m_in.readLine();
+        if (line.trimmed().isEmpty()) {
+            continue;
+        }
+
+        QStringList fields = m_parser->parseLine(line, m_delimiter);
+
+        // Check if we have enough fields
+        if (fields.size() <= m_maxIndex) {
+            qDebug() << "Line" << m_lineNumber << "has insufficient fields:" << fields.size()
+                     << "fields, need index" << m_maxIndex;
+            continue;
+        }
+
+        m_fields = fields;
+        m_rowLine = m_lineNumber;
+        return true;
+    }
+
+    m_file.close();
+    return false;
+}
+
+int CsvParser::RowReader::lineNumber() const
+{
+    return m_rowLine;
+}
+
+QString CsvParser::RowReader::value(int column) const
+{
+    return m_fields[m_indices[column]].trimmed();
+}
+
+QDateTime CsvParser::RowReader::dateTime(int column) const
+{
+    return m_parser->parseDateTime(value(column));
+}
+
+const QStringList &CsvParser::RowReader::fields() const
+{
+    return m_fields;
+}
@@ -12,6 +12,7 @@
 #include <QDateTime>
 #include <QFile>
 #include <QTextStream>
+#include <functional>
 
 // CSV parser with support for quoted fields and various date formats
 class CsvParser : public QObject
@@ -19,9 +20,34 @@ class CsvParser : public QObject
     Q_OBJECT
 
 public:
+    // Called for each row with valid timestamps; return false to stop reading
+    using TimestampRowHandler = std::function<bool(int lineNumber,
+                                                   const QDateTime &eventTime,
+                                                   const QDateTime &processTime,
+                                                   const QStringList &fields)>;
+
     // Constructor
     explicit CsvParser(QObject *parent = nullptr);
 
+    // Read only the header row of a CSV file
+    bool readHeader(const QString &filePath,
+                    QStringList &headers,
+                    QChar delimiter = ',');
+
+    // Stream rows with valid timestamps to a handler without keeping them in memory
+    bool forEachTimestampRow(const QString &filePath,
+                             const QString &eventTimeColumn,
+                             const QString &processTimeColumn,
+                             const TimestampRowHandler &handler,
+                             QChar delimiter = ',');
+
+    // Check whether the rows of a CSV file are in ascending order of a column;
+    // rows with an empty value are skipped
+    bool isSortedByColumn(const QString &filePath,
+                          const QString &column,
+                          bool &sorted,
+                          QChar delimiter = ',');
+
     // Parse timestamps from specified columns in a CSV file
     bool parseTimestamps(const QString &filePath, 
                          const QString &eventTimeColumn,
@@ -30,10 +56,53 @@ class CsvParser : public QObject
                          QList<QDateTime> &processTimes,
                          QChar delimiter = ',');
                          
+    // Find a column by name (case-insensitive), or -1 if it is missing
+    static int columnIndex(const QStringList &headers, const QString &column);
+
     // Get the last error message
     QString errorMessage() const;
 
+    // Reads the rows of a CSV file one at a time, exposing selected columns
+    class RowReader
+    {
+    public:
+        // Constructor
+        explicit RowReader(CsvParser *parser, QChar delimiter = ',');
+
+        // Open the file and locate the requested columns
+        bool open(const QString &filePath, const QStringList &columns);
+
+        // Advance to the next row that has all requested columns; false at the end
+        bool next();
+
+        // Line number of the current row
+        int lineNumber() const;
+
+        // Trimmed value of a requested column in the current row
+        QString value(int column) const;
+
+        // Requested column of the current row parsed as a timestamp
+        QDateTime dateTime(int column) const;
+
+        // Parsed (trimmed, unquoted) field values of the current row
+        const QStringList &fields() const;
+
+    private:
+        CsvParser *m_parser;    // Parser used for lines, dates and errors
+        QChar m_delimiter;      // Field delimiter
+        QFile m_file;           // Input file
+        QTextStream m_in;       // Input stream
+        QList<int> m_indices;   // Indices of the requested columns
+        int m_maxIndex;         // Highest requested column index
+        int m_lineNumber;       // Last line read
+        int m_rowLine;          // Line number of the current row
+        QStringList m_fields;   // Fields of the current row
+    };
+
 private:
+    // Open a CSV file and read its header row
+    bool openFile(QFile &file, QTextStream &in, QStringList &headers, QChar delimiter);
+
     // Parse a CSV line respecting quotes
     QStringList parseLine(const QString &line, QChar delimiter);
     
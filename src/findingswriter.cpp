@@ -0,0 +1,179 @@
+// Copyright (c) 2025 ddbeyin
+// MIT License - See LICENSE file for details
+
+#include "findingswriter.h"
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QStringConverter>
+
+FindingsWriter::FindingsWriter(QObject *parent)
+    : QObject(parent)
+    , m_format(Format::Csv)
+    , m_count(0)
+    , m_errorMessage("")
+{
+}
+
+FindingsWriter::~FindingsWriter()
+{
+    // An export that was never closed did not finish
+    cancel();
+}
+
+FindingsWriter::Format FindingsWriter::formatForFile(const QString &filePath)
+{
+    QString extension = QFileInfo(filePath).suffix().toLower();
+    if (extension == "jsonl") {
+        return Format::JsonLines;
+    }
+    return Format::Csv;
+}
+
+bool FindingsWriter::open(const QString &filePath, Format format, const QStringList &fieldNames)
+{
+    // Clear any previous state
+    cancel();
+    m_errorMessage.clear();
+    m_count = 0;
+    m_format = format;
+    m_fieldNames = fieldNames;
+
+    // JSON object keys must be unique or duplicate columns would overwrite each other
+    m_jsonKeys.clear();
+    for (const QString &name : m_fieldNames) {
+        m_jsonKeys.append(uniqueJsonKey(name.trimmed().isEmpty() ? QString("column_%1").arg(m_jsonKeys.size() + 1) : name));
+    }
+
+    m_file.setFileName(filePath);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        m_errorMessage = "Could not open the export file for writing.";
+        return false;
+    }
+
+    // QTextStream keeps its own write buffer, so rows go to disk in chunks
+    m_out.setDevice(&m_file);
+    m_out.setEncoding(QStringConverter::Utf8);
+
+    if (m_format == Format::Csv) {
+        QStringList header = { "line_number", "finding" };
+        for (const QString &name : m_fieldNames) {
+            header.append(escapeCsvField(name));
+        }
+        m_out << header.join(',') << '\n';
+    }
+
+    return checkStatus();
+}
+
+bool FindingsWriter::write(const Finding &finding)
+{
+    if (!m_file.isOpen()) {
+        m_errorMessage = "Export file is not open.";
+        return false;
+    }
+
+    if (m_format == Format::Csv) {
+        m_out << finding.lineNumber << ',' << escapeCsvField(finding.description);
+        for (const QString &field : finding.fields) {
+            m_out << ',' << escapeCsvField(field);
+        }
+        m_out << '\n';
+    } else {
+        // Extra fields without a matching header get a positional name
+        while (m_jsonKeys.size() < finding.fields.size()) {
+            m_jsonKeys.append(uniqueJsonKey(QString("column_%1").arg(m_jsonKeys.size() + 1)));
+        }
+
+        QJsonObject fields;
+        for (int i = 0; i < finding.fields.size(); i++) {
+            fields.insert(m_jsonKeys[i], finding.fields[i]);
+        }
+
+        QJsonObject record;
+        record.insert("line_number", finding.lineNumber);
+        record.insert("finding", finding.description);
+        record.insert("fields", fields);
+
+        m_out << QString::fromUtf8(QJsonDocument(record).toJson(QJsonDocument::Compact)) << '\n';
+    }
+
+    m_count++;
+    return checkStatus();
+}
+
+bool FindingsWriter::close()
+{
+    if (!m_file.isOpen()) {
+        return m_errorMessage.isEmpty();
+    }
+
+    m_out.flush();
+    bool success = checkStatus();
+    m_out.setDevice(nullptr);
+
+    if (!success) {
+        m_file.cancelWriting();
+        m_file.commit();
+        return false;
+    }
+
+    if (!m_file.commit()) {
+        m_errorMessage = QString("Could not save the export file: %1").arg(m_file.errorString());
+        return false;
+    }
+    return true;
+}
+
+void FindingsWriter::cancel()
+{
+    if (!m_file.isOpen()) {
+        return;
+    }
+
+    m_out.setDevice(nullptr);
+    m_file.cancelWriting();
+    m_file.commit();
+}
+
+int FindingsWriter::count() const
+{
+    return m_count;
+}
+
+QString FindingsWriter::errorMessage() const
+{
+    return m_errorMessage;
+}
+
+QString FindingsWriter::escapeCsvField(const QString &field) const
+{
+    if (!field.contains(',') && !field.contains('"') &&
+        !field.contains('\n') && !field.contains('\r')) {
+        return field;
+    }
+
+    QString escaped = field;
+    escaped.replace("\"", "\"\"");
+    return "\"" + escaped + "\"";
+}
+
+QString FindingsWriter::uniqueJsonKey(const QString &name) const
+{
+    // Repeated names become name_2, name_3, ...
+    QString key = name;
+    int suffix = 2;
+    while (m_jsonKeys.contains(key)) {
+        key = name + QString("_%1").arg(suffix++);
+    }
+    return key;
+}
+
+bool FindingsWriter::checkStatus()
+{
+    if (m_out.status() != QTextStream::Ok || m_file.error() != QFileDevice::NoError) {
+        m_errorMessage = QString("Could not write to the export file: %1").arg(m_file.errorString());
+        return false;
+    }
+    return true;
+}
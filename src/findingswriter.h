@@ -0,0 +1,84 @@
+// Copyright (c) 2025 ddbeyin
+// MIT License - See LICENSE file for details
+
+#ifndef FINDINGSWRITER_H
+#define FINDINGSWRITER_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QSaveFile>
+#include <QTextStream>
+#include <functional>
+
+// A single analysis finding tied to a row of the source log
+struct Finding
+{
+    int lineNumber = 0;     // Line number in the source file
+    QString description;    // Human readable description
+    QStringList fields;     // Parsed field values of the source row
+};
+
+// Called for each finding; return false to stop the analysis
+using FindingHandler = std::function<bool(const Finding &finding)>;
+
+// Streams findings to a CSV or JSON Lines file as they are produced; the file
+// only appears once close() succeeds, so a failed export leaves nothing behind
+class FindingsWriter : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Supported output formats
+    enum class Format {
+        Csv,
+        JsonLines
+    };
+
+    // Constructor
+    explicit FindingsWriter(QObject *parent = nullptr);
+
+    // Destructor
+    ~FindingsWriter();
+
+    // Pick an output format from the file extension
+    static Format formatForFile(const QString &filePath);
+
+    // Open the output file and write the header if the format has one
+    bool open(const QString &filePath, Format format, const QStringList &fieldNames);
+
+    // Append one finding to the output
+    bool write(const Finding &finding);
+
+    // Flush the output and replace the target file with it
+    bool close();
+
+    // Discard the output, leaving any existing target file untouched
+    void cancel();
+
+    // Number of findings written since the file was opened
+    int count() const;
+
+    // Get the last error message
+    QString errorMessage() const;
+
+private:
+    // Quote a CSV field if it contains special characters
+    QString escapeCsvField(const QString &field) const;
+
+    // Make a JSON field key that differs from the keys already in use
+    QString uniqueJsonKey(const QString &name) const;
+
+    // Check the stream and file for write errors
+    bool checkStatus();
+
+    QSaveFile m_file;           // Output file, committed on close
+    QTextStream m_out;          // Buffered output stream
+    Format m_format;            // Output format
+    QStringList m_fieldNames;   // Source column names
+    QStringList m_jsonKeys;     // Unique field keys for JSON Lines
+    int m_count;                // Findings written
+    QString m_errorMessage;     // Last error message
+};
+
+#endif // FINDINGSWRITER_H
@@ -0,0 +1,229 @@
+// Copyright (c) 2025 ddbeyin
+// MIT License - See LICENSE file for details
+
+#include "logcorrelator.h"
+#include <QHash>
+
+namespace {
+
+// Advance to the next row with a non-empty key (column 0); false at the end
+bool nextKeyed(CsvParser::RowReader &reader)
+{
+    while (reader.next()) {
+        if (!reader.value(0).isEmpty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// First server row seen for a key
+struct ServerEntry
+{
+    int lineNumber = 0;         // Server log line number
+    QDateTime processTime;      // Server process time
+    int firstClientLine = 0;    // Client line that first matched, or 0
+};
+
+// Describe a client row that has no server row with the same key
+QString describeMissing(const QString &keyColumn, const CsvParser::RowReader &client)
+{
+    return QString("No server acknowledgement for %1 '%2'.").arg(keyColumn, client.value(0));
+}
+
+// Describe a client row against its server match; empty if the row looks fine
+QString describeMatch(const QString &keyColumn,
+                      const CsvParser::RowReader &client,
+                      int serverLine,
+                      const QDateTime &processTime,
+                      int firstClientLine)
+{
+    if (firstClientLine != 0) {
+        return QString("Replayed event for %1 '%2': first sent on client log line %3.")
+            .arg(keyColumn, client.value(0), QString::number(firstClientLine));
+    }
+
+    // Client timestamps are only parsed for first matches
+    QDateTime eventTime = client.dateTime(1);
+    if (eventTime.isValid() && processTime.isValid() && eventTime > processTime) {
+        return QString("Clock skew for %1 '%2': client event_time %3 is ahead of server process_time %4 (server log line %5).")
+            .arg(keyColumn, client.value(0),
+                 eventTime.toString("yyyy-MM-dd HH:mm:ss"),
+                 processTime.toString("yyyy-MM-dd HH:mm:ss"),
+                 QString::number(serverLine));
+    }
+    return QString();
+}
+
+// Hand a finding for the current client row to the handler
+bool report(const CsvParser::RowReader &client, const QString &description, const FindingHandler &handler)
+{
+    Finding finding;
+    finding.lineNumber = client.lineNumber();
+    finding.description = description;
+    finding.fields = client.fields();
+    return handler(finding);
+}
+
+} // namespace
+
+LogCorrelator::LogCorrelator(QObject *parent)
+    : QObject(parent)
+    , m_csvParser(new CsvParser(this))
+    , m_lastStrategy(JoinStrategy::Hash)
+    , m_errorMessage("")
+{
+}
+
+bool LogCorrelator::correlate(const QString &clientFilePath,
+                              const QString &serverFilePath,
+                              const QString &keyColumn,
+                              const FindingHandler &handler,
+                              QChar delimiter)
+{
+    // Clear any previous error message
+    m_errorMessage.clear();
+
+    // Unsorted logs usually fail the check within a few rows. Sorted logs are
+    // read in full once more here, but that pass only compares keys and
+    // buys a merge join with constant memory instead of a hash table.
+    bool serverSorted = false;
+    if (!m_csvParser->isSortedByColumn(serverFilePath, keyColumn, serverSorted, delimiter)) {
+        m_errorMessage = "Server log: " + m_csvParser->errorMessage();
+        return false;
+    }
+
+    bool clientSorted = false;
+    if (serverSorted && !m_csvParser->isSortedByColumn(clientFilePath, keyColumn, clientSorted, delimiter)) {
+        m_errorMessage = "Client log: " + m_csvParser->errorMessage();
+        return false;
+    }
+
+    if (serverSorted && clientSorted) {
+        m_lastStrategy = JoinStrategy::Merge;
+        return mergeJoin(clientFilePath, serverFilePath, keyColumn, handler, delimiter);
+    }
+
+    m_lastStrategy = JoinStrategy::Hash;
+    return hashJoin(clientFilePath, serverFilePath, keyColumn, handler, delimiter);
+}
+
+bool LogCorrelator::hashJoin(const QString &clientFilePath,
+                             const QString &serverFilePath,
+                             const QString &keyColumn,
+                             const FindingHandler &handler,
+                             QChar delimiter)
+{
+    // Opening only reads the header, so check the client log before the build phase
+    CsvParser::RowReader client(m_csvParser, delimiter);
+    if (!client.open(clientFilePath, { keyColumn, LogCorrelator::kClientTimeColumn })) {
+        m_errorMessage = "Client log: " + m_csvParser->errorMessage();
+        return false;
+    }
+
+    // Build phase: keep only the first server row of each key
+    QHash<QString, ServerEntry> serverEntries;
+    {
+        CsvParser::RowReader server(m_csvParser, delimiter);
+        if (!server.open(serverFilePath, { keyColumn, LogCorrelator::kServerTimeColumn })) {
+            m_errorMessage = "Server log: " + m_csvParser->errorMessage();
+            return false;
+        }
+
+        while (nextKeyed(server)) {
+            QString key = server.value(0);
+            if (!serverEntries.contains(key)) {
+                ServerEntry entry;
+                entry.lineNumber = server.lineNumber();
+                entry.processTime = server.dateTime(1);
+                serverEntries.insert(key, entry);
+            }
+        }
+    }
+
+    // Probe phase: stream the client log against the table
+    while (nextKeyed(client)) {
+        QString description;
+        auto it = serverEntries.find(client.value(0));
+        if (it == serverEntries.end()) {
+            description = describeMissing(keyColumn, client);
+        } else {
+            description = describeMatch(keyColumn, client, it->lineNumber,
+                                        it->processTime, it->firstClientLine);
+            if (it->firstClientLine == 0) {
+                it->firstClientLine = client.lineNumber();
+            }
+        }
+
+        if (!description.isEmpty() && !report(client, description, handler)) {
+            m_errorMessage = QString("Processing stopped at line %1.").arg(client.lineNumber());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool LogCorrelator::mergeJoin(const QString &clientFilePath,
+                              const QString &serverFilePath,
+                              const QString &keyColumn,
+                              const FindingHandler &handler,
+                              QChar delimiter)
+{
+    CsvParser::RowReader server(m_csvParser, delimiter);
+    CsvParser::RowReader client(m_csvParser, delimiter);
+    if (!server.open(serverFilePath, { keyColumn, LogCorrelator::kServerTimeColumn })) {
+        m_errorMessage = "Server log: " + m_csvParser->errorMessage();
+        return false;
+    }
+    if (!client.open(clientFilePath, { keyColumn, LogCorrelator::kClientTimeColumn })) {
+        m_errorMessage = "Client log: " + m_csvParser->errorMessage();
+        return false;
+    }
+
+    // Equal keys are adjacent, so replays only need the last matched key.
+    // The server reader never moves past a matching key, so it stays on
+    // the first server row of that key, like the hash join.
+    bool hasServer = nextKeyed(server);
+    QString serverKey = hasServer ? server.value(0) : QString();
+    QString matchedKey;
+    int firstClientLine = 0;
+
+    while (nextKeyed(client)) {
+        QString clientKey = client.value(0);
+        while (hasServer && serverKey.compare(clientKey) < 0) {
+            hasServer = nextKeyed(server);
+            serverKey = hasServer ? server.value(0) : QString();
+        }
+
+        QString description;
+        if (hasServer && serverKey == clientKey) {
+            bool replayed = firstClientLine != 0 && matchedKey == clientKey;
+            description = describeMatch(keyColumn, client, server.lineNumber(),
+                                        server.dateTime(1), replayed ? firstClientLine : 0);
+            if (!replayed) {
+                matchedKey = clientKey;
+                firstClientLine = client.lineNumber();
+            }
+        } else {
+            description = describeMissing(keyColumn, client);
+        }
+
+        if (!description.isEmpty() && !report(client, description, handler)) {
+            m_errorMessage = QString("Processing stopped at line %1.").arg(client.lineNumber());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+LogCorrelator::JoinStrategy LogCorrelator::lastStrategy() const
+{
+    return m_lastStrategy;
+}
+
+QString LogCorrelator::errorMessage() const
+{
+    return m_errorMessage;
+}
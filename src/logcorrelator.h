@@ -0,0 +1,65 @@
+// Copyright (c) 2025 ddbeyin
+// MIT License - See LICENSE file for details
+
+#ifndef LOGCORRELATOR_H
+#define LOGCORRELATOR_H
+
+#include <QObject>
+#include <QString>
+#include <QDateTime>
+#include "csvparser.h"
+#include "findingswriter.h"
+
+// Joins a client event log with a server log on a shared key column
+class LogCorrelator : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Join algorithm used for the last correlation
+    enum class JoinStrategy {
+        Hash,   // Server log is loaded into a hash table, client log is streamed
+        Merge   // Both logs are streamed side by side; requires key order
+    };
+
+    // Timestamp columns of the client and server logs
+    static constexpr const char *kClientTimeColumn = "event_time";
+    static constexpr const char *kServerTimeColumn = "process_time";
+
+    // Constructor
+    explicit LogCorrelator(QObject *parent = nullptr);
+
+    // Report clock skew, missing acknowledgements and replayed events
+    bool correlate(const QString &clientFilePath,
+                   const QString &serverFilePath,
+                   const QString &keyColumn,
+                   const FindingHandler &handler,
+                   QChar delimiter = ',');
+
+    // Get the join algorithm picked by the last correlation
+    JoinStrategy lastStrategy() const;
+
+    // Get the last error message
+    QString errorMessage() const;
+
+private:
+    // Join by loading the server log into a hash table
+    bool hashJoin(const QString &clientFilePath,
+                  const QString &serverFilePath,
+                  const QString &keyColumn,
+                  const FindingHandler &handler,
+                  QChar delimiter);
+
+    // Join by reading both logs in key order
+    bool mergeJoin(const QString &clientFilePath,
+                   const QString &serverFilePath,
+                   const QString &keyColumn,
+                   const FindingHandler &handler,
+                   QChar delimiter);
+
+    CsvParser *m_csvParser;         // CSV parser
+    JoinStrategy m_lastStrategy;    // Join algorithm of the last run
+    QString m_errorMessage;         // Last error message
+};
+
+#endif // LOGCORRELATOR_H
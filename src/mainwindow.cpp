@@ -14,12 +14,32 @@
 #include <QVBoxLayout>
 #include <QTextBrowser>
 #include <QDialogButtonBox>
+#include <QInputDialog>
+#include <QSignalBlocker>
+
+// Findings shown in the results box; the rest are only available through export
+static const int kMaxDisplayedFindings = 1000;
+
+// Check whether a column name looks like an identifier: id, session_id, sessionId, SessionID
+static bool isIdColumn(const QString &column)
+{
+    if (column.compare("id", Qt::CaseInsensitive) == 0 ||
+        column.endsWith("_id", Qt::CaseInsensitive) ||
+        column.endsWith("-id", Qt::CaseInsensitive)) {
+        return true;
+    }
+
+    // camelCase names need a lowercase letter before the suffix, so "void" does not match
+    return (column.endsWith("Id") || column.endsWith("ID")) &&
+           column.size() > 2 && column[column.size() - 3].isLower();
+}
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
     , lastDirectory("")
     , m_csvParser(new CsvParser(this))
+    , m_logCorrelator(new LogCorrelator(this))
 {
     ui->setupUi(this);
 
@@ -29,6 +49,7 @@ MainWindow::MainWindow(QWidget *parent)
 
     // Initialize available analysis modules
     ui->moduleComboBox->addItem("Time Discrepancy");
+    ui->moduleComboBox->addItem("Log Correlation");
 
     // Connect window controls
     connect(ui->actionAlways_on_Top, &QAction::triggered, this, &MainWindow::on_actionAlways_on_Top_triggered);
@@ -40,6 +61,8 @@ MainWindow::MainWindow(QWidget *parent)
     connect(ui->actionOpen, &QAction::triggered, this, &MainWindow::onLoadButtonClicked);
     connect(ui->resetButton, &QPushButton::clicked, this, &MainWindow::onResetButtonClicked);
     connect(ui->actionReset, &QAction::triggered, this, &MainWindow::onResetButtonClicked);
+    connect(ui->exportButton, &QPushButton::clicked, this, &MainWindow::onExportButtonClicked);
+    connect(ui->actionExport, &QAction::triggered, this, &MainWindow::onExportButtonClicked);
 
     // Connect analysis controls
     connect(ui->moduleComboBox, &QComboBox::currentTextChanged, this, &MainWindow::onModuleSelected);
@@ -47,6 +70,8 @@ MainWindow::MainWindow(QWidget *parent)
 
     // Start with analysis controls disabled until file is loaded
     ui->analyzeButton->setEnabled(false);
+    ui->exportButton->setEnabled(false);
+    ui->actionExport->setEnabled(false);
     ui->moduleComboBox->setEnabled(false);
 }
 
@@ -99,10 +124,16 @@ void MainWindow::handleDroppedFile(const QString &filePath)
         lastDirectory = QFileInfo(filePath).path();
         currentFilePath = filePath;
 
+        // A new client log needs its own server log and join column
+        serverFilePath.clear();
+        correlationKeyColumn.clear();
+
         // Update UI state
         QFileInfo fileInfo(filePath);
         ui->loadButton->setText("Loaded: " + fileInfo.fileName());
         ui->analyzeButton->setEnabled(true);
+        ui->exportButton->setEnabled(true);
+        ui->actionExport->setEnabled(true);
         ui->moduleComboBox->setEnabled(true);
 
         // Clear any previous analysis results
@@ -141,29 +172,91 @@ void MainWindow::onLoadButtonClicked()
 
 void MainWindow::onModuleSelected(const QString &text)
 {
+    // Nothing to analyze until a file is loaded
+    if (currentFilePath.isEmpty()) {
+        return;
+    }
+
     // Run analysis when module is selected (can be expanded for other modules)
     if (text == "Time Discrepancy") {
         analyzeTimeDiscrepancy();
+    } else if (text == "Log Correlation") {
+        // Selecting the module again lets the user pick a different server log or column
+        serverFilePath.clear();
+        correlationKeyColumn.clear();
+        analyzeLogCorrelation();
     }
 }
 
-bool MainWindow::readCSVFile(const QString &filePath, QList<QDateTime> &eventTimes, QList<QDateTime> &processTimes)
+bool MainWindow::scanTimeDiscrepancies(const QString &filePath, const FindingHandler &handler)
 {
-    bool success = m_csvParser->parseTimestamps(
-        filePath, 
+    // Look for cases where event time is ahead of the process time
+    // This could indicate time manipulation
+    return m_csvParser->forEachTimestampRow(
+        filePath,
         "event_time",     // Name of event time column
         "process_time",   // Name of process time column
-        eventTimes, 
-        processTimes
+        [&](int lineNumber, const QDateTime &eventTime, const QDateTime &processTime, const QStringList &fields) {
+            if (eventTime <= processTime) {
+                return true;
+            }
+
+            Finding finding;
+            finding.lineNumber = lineNumber;
+            finding.description = QString("The player's event_time is ahead of the process_time on %1. The player made life hack.")
+                                      .arg(eventTime.toString("yyyy-MM-dd HH:mm:ss"));
+            finding.fields = fields;
+            return handler(finding);
+        }
     );
-    
-    if (!success) {
-        QMessageBox::warning(this, "Error", m_csvParser->errorMessage());
+}
+
+bool MainWindow::scanFindings(const QString &module, const FindingHandler &handler, QString &errorMessage)
+{
+    bool success = false;
+    if (module == "Time Discrepancy") {
+        success = scanTimeDiscrepancies(currentFilePath, handler);
+        errorMessage = m_csvParser->errorMessage();
+    } else if (module == "Log Correlation") {
+        success = m_logCorrelator->correlate(currentFilePath, serverFilePath, correlationKeyColumn, handler);
+        errorMessage = m_logCorrelator->errorMessage();
+    } else {
+        errorMessage = QString("Unknown analysis module '%1'.").arg(module);
     }
-    
     return success;
 }
 
+bool MainWindow::displayFindings(const QString &module, const QString &emptyMessage)
+{
+    // Only keep a bounded number of findings for display
+    QString results;
+    int findingCount = 0;
+    QString errorMessage;
+
+    bool success = scanFindings(module, [&](const Finding &finding) {
+        if (findingCount < kMaxDisplayedFindings) {
+            results += finding.description + "\n";
+        }
+        findingCount++;
+        return true;
+    }, errorMessage);
+
+    if (!success) {
+        QMessageBox::warning(this, "Error", errorMessage);
+        return false;
+    }
+
+    if (findingCount == 0) {
+        results = emptyMessage;
+    } else if (findingCount > kMaxDisplayedFindings) {
+        results += QString("... and %1 more. Use Export to save all findings.\n")
+                       .arg(findingCount - kMaxDisplayedFindings);
+    }
+
+    ui->resultsTextBox->setPlainText(results);
+    return true;
+}
+
 void MainWindow::analyzeTimeDiscrepancy()
 {
     if (currentFilePath.isEmpty()) {
@@ -171,29 +264,116 @@ void MainWindow::analyzeTimeDiscrepancy()
         return;
     }
 
-    QList<QDateTime> eventTimes, processTimes;
-    if (!readCSVFile(currentFilePath, eventTimes, processTimes)) {
-        return;
+    displayFindings("Time Discrepancy", "No time discrepancies found.");
+}
+
+bool MainWindow::selectCorrelationInputs()
+{
+    if (!serverFilePath.isEmpty() && !correlationKeyColumn.isEmpty()) {
+        return true;
     }
 
-    // Look for cases where event time is ahead of the process time
-    // This could indicate time manipulation
-    QString results;
-    bool discrepanciesFound = false;
+    // The loaded file is the client log; ask for the matching server log
+    QString startingDir = lastDirectory.isEmpty() ? QDir::homePath() : lastDirectory;
+    QString filePath = QFileDialog::getOpenFileName(
+        this,
+        tr("Open Server Log"),
+        startingDir,
+        "CSV Files (*.csv);;All Files (*)"
+        );
+
+    if (filePath.isEmpty()) {
+        return false;
+    }
+
+    QStringList clientHeaders, serverHeaders;
+    if (!m_csvParser->readHeader(currentFilePath, clientHeaders)) {
+        QMessageBox::warning(this, "Error", "Client log: " + m_csvParser->errorMessage());
+        return false;
+    }
+    if (!m_csvParser->readHeader(filePath, serverHeaders)) {
+        QMessageBox::warning(this, "Error", "Server log: " + m_csvParser->errorMessage());
+        return false;
+    }
 
-    for (int i = 0; i < eventTimes.size(); i++) {
-        if (eventTimes[i] > processTimes[i]) {
-            discrepanciesFound = true;
-            results += QString("The player's event_time is ahead of the process_time on %1. The player made life hack.\n")
-                           .arg(eventTimes[i].toString("yyyy-MM-dd HH:mm:ss"));
+    // Both logs need their timestamp column before a join column is worth asking for
+    if (CsvParser::columnIndex(clientHeaders, LogCorrelator::kClientTimeColumn) == -1) {
+        QMessageBox::warning(this, "Error", QString("Client log: Required column '%1' not found. Found columns: %2")
+                                                .arg(LogCorrelator::kClientTimeColumn, clientHeaders.join(", ")));
+        return false;
+    }
+    if (CsvParser::columnIndex(serverHeaders, LogCorrelator::kServerTimeColumn) == -1) {
+        QMessageBox::warning(this, "Error", QString("Server log: Required column '%1' not found. Found columns: %2")
+                                                .arg(LogCorrelator::kServerTimeColumn, serverHeaders.join(", ")));
+        return false;
+    }
+
+    // Offer the columns both logs share, preferring the first id column
+    QStringList keyColumns;
+    int defaultIndex = -1;
+    for (const QString &header : clientHeaders) {
+        QString column = header.trimmed();
+        if (column.isEmpty() || keyColumns.contains(column, Qt::CaseInsensitive) ||
+            CsvParser::columnIndex(serverHeaders, column) == -1) {
+            continue;
+        }
+        if (defaultIndex == -1 && isIdColumn(column)) {
+            defaultIndex = keyColumns.size();
         }
+        keyColumns.append(column);
     }
 
-    if (!discrepanciesFound) {
-        results = "No time discrepancies found.";
+    if (keyColumns.isEmpty()) {
+        QMessageBox::warning(this, "Error", "The client and server logs have no columns in common.");
+        return false;
     }
 
-    ui->resultsTextBox->setPlainText(results);
+    if (defaultIndex == -1) {
+        defaultIndex = 0;
+    }
+
+    bool ok = false;
+    QString column = QInputDialog::getItem(
+        this,
+        tr("Join Column"),
+        tr("Join the logs on:"),
+        keyColumns,
+        defaultIndex,
+        false,
+        &ok
+        );
+
+    if (!ok) {
+        return false;
+    }
+
+    // Only keep inputs that passed the checks above
+    serverFilePath = filePath;
+    correlationKeyColumn = column;
+    return true;
+}
+
+void MainWindow::analyzeLogCorrelation()
+{
+    if (currentFilePath.isEmpty()) {
+        QMessageBox::warning(this, "Error", "Please load a file first.");
+        return;
+    }
+
+    if (!selectCorrelationInputs()) {
+        return;
+    }
+
+    if (!displayFindings("Log Correlation", "No correlation issues found.")) {
+        // Ask again next time instead of repeating the same failure
+        serverFilePath.clear();
+        correlationKeyColumn.clear();
+        return;
+    }
+
+    QString strategy = m_logCorrelator->lastStrategy() == LogCorrelator::JoinStrategy::Merge ? "merge" : "hash";
+    ui->statusbar->showMessage(QString("Joined with %1 on '%2' using a %3 join")
+                                   .arg(QFileInfo(serverFilePath).fileName(), correlationKeyColumn, strategy));
 }
 
 void MainWindow::onAnalyzeButtonClicked()
@@ -202,13 +382,99 @@ void MainWindow::onAnalyzeButtonClicked()
     QString selectedModule = ui->moduleComboBox->currentText();
     if (selectedModule == "Time Discrepancy") {
         analyzeTimeDiscrepancy();
+    } else if (selectedModule == "Log Correlation") {
+        analyzeLogCorrelation();
+    }
+}
+
+void MainWindow::onExportButtonClicked()
+{
+    if (currentFilePath.isEmpty()) {
+        QMessageBox::warning(this, "Error", "Please load a file first.");
+        return;
+    }
+
+    QString selectedModule = ui->moduleComboBox->currentText();
+    if (selectedModule == "Log Correlation" && !selectCorrelationInputs()) {
+        return;
     }
+
+    // Field names come from the source header
+    QStringList headers;
+    if (!m_csvParser->readHeader(currentFilePath, headers)) {
+        QMessageBox::warning(this, "Error", m_csvParser->errorMessage());
+        return;
+    }
+
+    QString filters = "CSV Files (*.csv);;JSON Lines Files (*.jsonl)";
+    QString defaultPath = QDir(lastDirectory.isEmpty() ? QDir::homePath() : lastDirectory)
+                              .filePath(QFileInfo(currentFilePath).completeBaseName() + "_findings.csv");
+    QString selectedFilter;
+
+    QString exportPath = QFileDialog::getSaveFileName(
+        this,
+        tr("Export Findings"),
+        defaultPath,
+        filters,
+        &selectedFilter
+        );
+
+    if (exportPath.isEmpty()) {
+        return;
+    }
+
+    // Follow the chosen filter when the name has no recognized extension
+    FindingsWriter::Format format = FindingsWriter::formatForFile(exportPath);
+    QString extension = QFileInfo(exportPath).suffix().toLower();
+    if (extension != "csv" && extension != "jsonl" && selectedFilter.contains("jsonl")) {
+        format = FindingsWriter::Format::JsonLines;
+    }
+
+    FindingsWriter writer;
+    if (!writer.open(exportPath, format, headers)) {
+        QMessageBox::warning(this, "Error", writer.errorMessage());
+        return;
+    }
+
+    QString errorMessage;
+    bool success = scanFindings(selectedModule, [&](const Finding &finding) {
+        return writer.write(finding);
+    }, errorMessage);
+
+    // Never leave a partial export behind
+    if (!success) {
+        writer.cancel();
+
+        // Write errors take priority over the analysis "stopped" message
+        if (!writer.errorMessage().isEmpty()) {
+            QMessageBox::warning(this, "Error", writer.errorMessage());
+            return;
+        }
+
+        QMessageBox::warning(this, "Error", errorMessage);
+        if (selectedModule == "Log Correlation") {
+            serverFilePath.clear();
+            correlationKeyColumn.clear();
+        }
+        return;
+    }
+
+    if (!writer.close()) {
+        QMessageBox::warning(this, "Error", writer.errorMessage());
+        return;
+    }
+
+    ui->statusbar->showMessage(QString("Exported %1 findings to %2")
+                                   .arg(writer.count())
+                                   .arg(QDir::toNativeSeparators(exportPath)));
 }
 
 void MainWindow::onResetButtonClicked()
 {
     // Clear file selection
     currentFilePath.clear();
+    serverFilePath.clear();
+    correlationKeyColumn.clear();
     ui->loadButton->setText("Load");
 
     // Reset all result displays
@@ -218,10 +484,13 @@ void MainWindow::onResetButtonClicked()
 
     // Disable analysis controls
     ui->analyzeButton->setEnabled(false);
+    ui->exportButton->setEnabled(false);
+    ui->actionExport->setEnabled(false);
     ui->moduleComboBox->setEnabled(false);
 
-    // Reset module selection
+    // Reset module selection without running the selected module
     if (ui->moduleComboBox->count() > 0) {
+        const QSignalBlocker blocker(ui->moduleComboBox);
         ui->moduleComboBox->setCurrentIndex(0);
     }
 }
@@ -14,6 +14,8 @@
 #include <QMimeData>
 #include "version.h"
 #include "csvparser.h"
+#include "findingswriter.h"
+#include "logcorrelator.h"
 
 QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -56,9 +58,15 @@ private slots:
     // Run time discrepancy analysis
     void analyzeTimeDiscrepancy();
 
+    // Run client/server log correlation analysis
+    void analyzeLogCorrelation();
+
     // Perform analysis with selected module
     void onAnalyzeButtonClicked();
 
+    // Stream findings of the selected module to a file
+    void onExportButtonClicked();
+
     // Reset application state
     void onResetButtonClicked();
 
@@ -72,12 +80,22 @@ private slots:
     Ui::MainWindow *ui;                 // UI components
     QString currentFilePath;            // Current file path
     QString lastDirectory;              // Last used directory
+    QString serverFilePath;             // Server log joined with the current file
+    QString correlationKeyColumn;       // Column the logs are joined on
     CsvParser *m_csvParser;             // CSV parser
+    LogCorrelator *m_logCorrelator;     // Client/server log correlator
+
+    // Stream time discrepancy findings to a handler
+    bool scanTimeDiscrepancies(const QString &filePath, const FindingHandler &handler);
+
+    // Stream findings of a module to a handler
+    bool scanFindings(const QString &module, const FindingHandler &handler, QString &errorMessage);
+
+    // Show a bounded number of a module's findings in the results box
+    bool displayFindings(const QString &module, const QString &emptyMessage);
 
-    // Parse timestamps from CSV file
-    bool readCSVFile(const QString &filePath,
-                     QList<QDateTime> &eventTimes,
-                     QList<QDateTime> &processTimes);
+    // Ask for the server log and join column if not chosen yet
+    bool selectCorrelationInputs();
 };
 
 #endif // MAINWINDOW_H
\ No newline at end of file